@@ -94,8 +94,10 @@ int Cell::collapse() {
 
     //std::wcout << "Chose option " << i << ": Collapsing cell to " << *it << ".\n";
 
-    this->collapse(*it);
-    return *it;
+    // Copy the value out first, as collapsing clears the option set and invalidates the iterator
+    int val = *it;
+    this->collapse(val);
+    return val;
 }
 
 
@@ -4,9 +4,13 @@
 int main(int argc, char *argv[]) {
 
     std::string debugFlag = "-g";
+    std::string statsFlag = "-s";
+    std::string disableFlags[NUMTECHNIQUES] = {"-no-pointing", "-no-boxline", "-no-xwing", "-no-swordfish"};
 
-    if (argc != 2 && argc != 3) {
-        std::cout << "Usage: ./a.exe filename [" << debugFlag << " for debugModeEnabled]\n";
+    if (argc < 2) {
+        std::cout << "Usage: ./a.exe filename [" << debugFlag << " for debugModeEnabled] [" << statsFlag << " for technique stats]";
+        for (const std::string &flag : disableFlags) std::cout << " [" << flag << "]";
+        std::cout << "\n";
         return 1;
     }
 
@@ -14,14 +18,38 @@ int main(int argc, char *argv[]) {
     std::string solutionDir = "./solutions";
     std::string puzzleName = argv[1];
 
-    bool debugModeEnabled = ((argc == 3) && (debugFlag.compare(argv[2]) == 0));
-
     Solver s;
+
+    bool debugModeEnabled = false;
+    bool statsEnabled = false;
+    for (int i = 2; i < argc; i++) {
+        bool validFlag = false;
+
+        if (debugFlag.compare(argv[i]) == 0) {
+            debugModeEnabled = validFlag = true;
+        } else if (statsFlag.compare(argv[i]) == 0) {
+            statsEnabled = validFlag = true;
+        }
+
+        for (int t = 0; t < NUMTECHNIQUES; t++) {
+            if (disableFlags[t].compare(argv[i]) == 0) {
+                s.setTechniqueEnabled(Technique(t), false);
+                validFlag = true;
+            }
+        }
+
+        if (!validFlag) {
+            std::cout << "Unknown flag " << argv[i] << "\n";
+            return 1;
+        }
+    }
+
     if (s.generateGridFromFile(puzzleDir, puzzleName)) {
         s.printGrid();
         int numStepsToSolve = s.solve(debugModeEnabled);
         s.printGrid();
         std::cout << "Solved in " << numStepsToSolve << " steps.\n";
+        if (statsEnabled) s.printTechniqueStats();
     }
 
     return 0;
@@ -8,6 +8,9 @@
 #include <unordered_map>
 
 
+static const wchar_t *techniqueNames[NUMTECHNIQUES] = {L"Pointing", L"Box-line", L"X-Wing", L"Swordfish"};
+
+
 Solver::Solver(std::string puzzleDir, std::string puzzleName) {
     if (!puzzleDir.empty() && !puzzleName.empty()) {
         this->generateGridFromFile(puzzleDir, puzzleName);
@@ -26,8 +29,13 @@ void Solver::resetCells() {
 
 bool Solver::generateGridFromFile(std::string puzzleDir, std::string puzzleName) {
 
-    // Reset all cells
+    // Reset all cells and solve statistics
     this->resetCells();
+    this->numCellsRemaining = GRIDSIZE * GRIDSIZE;
+    for (TechniqueStats &stats : techniqueStats) stats = TechniqueStats();
+    this->numGuesses = 0;
+    this->numBacktracks = 0;
+    this->solveTime = std::chrono::steady_clock::duration::zero();
 
     std::string puzzleFileName = puzzleDir + "/" + puzzleName;
     std::ifstream fp;
@@ -190,6 +198,8 @@ int Solver::solve(bool debugModeEnabled) {
     
     // When setting up the grid, we already collapsed the cells and setup their options appropriately, so we just need to iterate on this process
 
+    auto solveStart = std::chrono::steady_clock::now();
+
     int numIterations = 0;
     while (numCellsRemaining > 0) {
 
@@ -218,20 +228,28 @@ int Solver::solve(bool debugModeEnabled) {
 
             if (debugModeEnabled) std::wcout << "Backtracking...\n";
 
+            this->numBacktracks++;
             if (this->revertState()) {
                 std::wcout << "No solution found.\n";
+                this->solveTime += std::chrono::steady_clock::now() - solveStart;
                 return -1;
             }
 
             continue;
         }
 
+        // Before guessing, run the enabled logical techniques; if they eliminated any options, rescan the grid for certain cells
+        if (fewestOptions > 1 && this->applyTechniques()) {
+            continue;
+        }
+
         // Select a random cell to collapse
         std::pair<int, int> &chosenCellCoord = cellChoices[std::rand() % cellChoices.size()];
 
         // If we need to make a guess (there is more than one option for the fewest cell), then save the current state for backtracking purposes
         if (fewestOptions > 1) {
             this->saveState(chosenCellCoord);
+            this->numGuesses++;
         }
 
         // Collapse the selected cell to one of its options at random
@@ -246,6 +264,8 @@ int Solver::solve(bool debugModeEnabled) {
         }
     }
 
+    this->solveTime += std::chrono::steady_clock::now() - solveStart;
+
     // If we solve, return true
     return numIterations;
 
@@ -310,6 +330,13 @@ void Solver::reduceOptions(std::pair<int, int> coord, int val) {
     }
 
 
+    this->advancedReduceUnits(rowsToReduce, colsToReduce, boxesToReduce);
+
+}
+
+
+void Solver::advancedReduceUnits(const std::unordered_set<int> &rowsToReduce, const std::unordered_set<int> &colsToReduce, const std::unordered_set<int> &boxesToReduce) {
+
     // For each row, col, & box, generate a list of coordinates to pass to the advanced reduce function, then run the advanced reduction on the set of coordinates
     for (const int &row : rowsToReduce) {
         std::vector<std::pair<int, int>> coords;
@@ -412,6 +439,297 @@ void Solver::advancedReduceOptions(std::vector<std::pair<int, int>> &coords) {
 }
 
 
+void Solver::setTechniqueEnabled(Technique technique, bool enabled) {
+    this->techniqueEnabled[technique] = enabled;
+}
+
+
+void Solver::printTechniqueStats() {
+    /// Print the cost (calls and time spent) and benefit (options eliminated) of each propagation stage
+    /// Compare against the guess count and total solve time with the stage disabled to decide whether it is worth running
+
+    auto toMicroseconds = [] (std::chrono::steady_clock::duration duration) -> long long {
+        return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    };
+
+    for (int t = 0; t < NUMTECHNIQUES; t++) {
+        std::wcout << techniqueNames[t] << ": ";
+        if (!techniqueEnabled[t]) {
+            std::wcout << "disabled\n";
+            continue;
+        }
+        std::wcout << techniqueStats[t].numCalls << " calls, "
+                   << techniqueStats[t].numEliminations << " eliminations, "
+                   << toMicroseconds(techniqueStats[t].timeTaken) << "us\n";
+    }
+
+    std::wcout << "Guesses: " << numGuesses << ", Backtracks: " << numBacktracks << "\n";
+    std::wcout << "Total solve time: " << toMicroseconds(solveTime) << "us\n";
+}
+
+
+bool Solver::applyTechniques() {
+    /// Run the enabled propagation stages in order of increasing cost, stopping after the first one that eliminates any options
+    /// The affected units are then passed back through the advanced reduction, so that new naked/hidden subsets are found before the next stage is tried
+    /// Each stage's time and eliminations cover the same work: the position bitmap rebuild (paid by the first enabled stage), the stage itself, and the follow-up reduction
+    /// Returns true if any options were eliminated
+
+    auto countOptions = [this] () -> int {
+        int numOptions = 0;
+        for (int y = 0; y < GRIDSIZE; y++)
+            for (int x = 0; x < GRIDSIZE; x++)
+                numOptions += grid[y][x].numOptions();
+        return numOptions;
+    };
+
+    bool candidatePositionsBuilt = false;
+
+    for (int t = 0; t < NUMTECHNIQUES; t++) {
+
+        if (!techniqueEnabled[t]) continue;
+
+        auto start = std::chrono::steady_clock::now();
+
+        if (!candidatePositionsBuilt) {
+            this->updateCandidatePositions();
+            candidatePositionsBuilt = true;
+        }
+
+        int numEliminated = 0;
+        switch (t) {
+            case POINTING:  numEliminated = this->pointingReduceOptions(); break;
+            case BOXLINE:   numEliminated = this->boxLineReduceOptions();  break;
+            case XWING:     numEliminated = this->fishReduceOptions(2);    break;
+            case SWORDFISH: numEliminated = this->fishReduceOptions(3);    break;
+        }
+
+        if (numEliminated > 0) {
+            std::unordered_set<int> rowsToReduce, colsToReduce, boxesToReduce;
+            for (const auto &[x, y] : eliminatedCellCoords) {
+                rowsToReduce.insert(y);
+                colsToReduce.insert(x);
+                boxesToReduce.insert((x / BOXWIDTH) + (y / BOXHEIGHT) * NUMBOXESPERROW);
+            }
+            eliminatedCellCoords.clear();
+
+            // Credit the stage with any options the follow-up reduction removes, as it is included in the stage's time
+            int numOptionsBefore = countOptions();
+            this->advancedReduceUnits(rowsToReduce, colsToReduce, boxesToReduce);
+            numEliminated += numOptionsBefore - countOptions();
+        }
+
+        techniqueStats[t].numCalls++;
+        techniqueStats[t].numEliminations += numEliminated;
+        techniqueStats[t].timeTaken += std::chrono::steady_clock::now() - start;
+
+        if (numEliminated > 0) return true;
+    }
+
+    return false;
+}
+
+
+void Solver::updateCandidatePositions() {
+    /// Rebuild the per-value position bitmaps for every row and column from the current cell options
+
+    for (int val = 0; val < GRIDSIZE; val++) {
+        for (int i = 0; i < GRIDSIZE; i++) {
+            rowPositions[val][i].reset();
+            colPositions[val][i].reset();
+        }
+    }
+
+    for (int y = 0; y < GRIDSIZE; y++) {
+        for (int x = 0; x < GRIDSIZE; x++) {
+            for (const int &val : grid[y][x].getOptions()) {
+                rowPositions[val - 1][y].set(x);
+                colPositions[val - 1][x].set(y);
+            }
+        }
+    }
+}
+
+
+int Solver::eliminateOption(int x, int y, int val) {
+    /// Removes the value as an option from the cell at (x, y), keeping the position bitmaps in sync
+    /// Returns 1 if the value was removed, 0 otherwise
+
+    if (!grid[y][x].removeOption(val)) return 0;
+
+    rowPositions[val - 1][y].reset(x);
+    colPositions[val - 1][x].reset(y);
+    eliminatedCellCoords.push_back({x, y});
+    return 1;
+}
+
+
+int Solver::pointingReduceOptions() {
+    /// Pointing pairs/triples: if every option for a value within a box lies on a single row (or column),
+    /// then that value must be placed in this box on that line, and can be removed from the rest of the line
+    /// Returns the number of options eliminated
+
+    int numEliminated = 0;
+
+    for (int box = 0; box < GRIDSIZE; box++) {
+
+        int minX = (box % NUMBOXESPERROW) * BOXWIDTH;
+        int minY = (box / NUMBOXESPERROW) * BOXHEIGHT;
+
+        int maxX = minX + BOXWIDTH;
+        int maxY = minY + BOXHEIGHT;
+
+        for (int val = 1; val <= GRIDSIZE; val++) {
+
+            // Find which rows and columns of this box contain the value as an option
+            std::bitset<GRIDSIZE> rowsInBox, colsInBox;
+            for (int y = minY; y < maxY; y++) {
+                for (int x = minX; x < maxX; x++) {
+                    if (rowPositions[val - 1][y][x]) {
+                        rowsInBox.set(y);
+                        colsInBox.set(x);
+                    }
+                }
+            }
+
+            if (rowsInBox.count() == 1) {
+                int y = minY;
+                while (!rowsInBox[y]) y++;
+                for (int x = 0; x < GRIDSIZE; x++) {
+                    if (x < minX || x >= maxX) numEliminated += this->eliminateOption(x, y, val);
+                }
+            }
+
+            if (colsInBox.count() == 1) {
+                int x = minX;
+                while (!colsInBox[x]) x++;
+                for (int y = 0; y < GRIDSIZE; y++) {
+                    if (y < minY || y >= maxY) numEliminated += this->eliminateOption(x, y, val);
+                }
+            }
+        }
+    }
+
+    return numEliminated;
+}
+
+
+int Solver::boxLineReduceOptions() {
+    /// Box-line reduction: if every option for a value within a row (or column) lies in a single box,
+    /// then that value must be placed in this box on that line, and can be removed from the rest of the box
+    /// Returns the number of options eliminated
+
+    int numEliminated = 0;
+
+    for (int val = 1; val <= GRIDSIZE; val++) {
+        for (int i = 0; i < GRIDSIZE; i++) {
+
+            // Rows: find which horizontal boxes along row i contain the value as an option
+            std::bitset<GRIDSIZE> rowBoxes;
+            for (int x = 0; x < GRIDSIZE; x++) {
+                if (rowPositions[val - 1][i][x]) rowBoxes.set(x / BOXWIDTH);
+            }
+
+            if (rowBoxes.count() == 1) {
+                int boxX = 0;
+                while (!rowBoxes[boxX]) boxX++;
+                int minY = (i / BOXHEIGHT) * BOXHEIGHT;
+                for (int y = minY; y < minY + BOXHEIGHT; y++) {
+                    if (y == i) continue;
+                    for (int x = boxX * BOXWIDTH; x < (boxX + 1) * BOXWIDTH; x++) {
+                        numEliminated += this->eliminateOption(x, y, val);
+                    }
+                }
+            }
+
+            // Columns: find which vertical boxes along column i contain the value as an option
+            std::bitset<GRIDSIZE> colBoxes;
+            for (int y = 0; y < GRIDSIZE; y++) {
+                if (colPositions[val - 1][i][y]) colBoxes.set(y / BOXHEIGHT);
+            }
+
+            if (colBoxes.count() == 1) {
+                int boxY = 0;
+                while (!colBoxes[boxY]) boxY++;
+                int minX = (i / BOXWIDTH) * BOXWIDTH;
+                for (int x = minX; x < minX + BOXWIDTH; x++) {
+                    if (x == i) continue;
+                    for (int y = boxY * BOXHEIGHT; y < (boxY + 1) * BOXHEIGHT; y++) {
+                        numEliminated += this->eliminateOption(x, y, val);
+                    }
+                }
+            }
+        }
+    }
+
+    return numEliminated;
+}
+
+
+int Solver::fishReduceOptions(int size) {
+    /// Fish patterns of the given size (2 = X-Wing, 3 = Swordfish), using both rows and columns as base lines
+    /// Returns the number of options eliminated
+
+    int numEliminated = 0;
+    for (int val = 1; val <= GRIDSIZE; val++) {
+        numEliminated += this->fishReduceLines(size, val, rowPositions[val - 1], true);
+        numEliminated += this->fishReduceLines(size, val, colPositions[val - 1], false);
+    }
+    return numEliminated;
+}
+
+
+int Solver::fishReduceLines(int size, int val, std::bitset<GRIDSIZE> (&linePositions)[GRIDSIZE], bool baseIsRow) {
+    /// If the options for a value in 'size' base lines all lie within the same 'size' cover lines (perpendicular to the base),
+    /// then the value must be placed in each cover line at one of those base lines, and can be removed from the rest of each cover line
+    /// e.g. for an X-Wing on rows, if a value is only an option at columns [a, b] in two rows, it can be removed from columns a and b in all other rows
+    /// Returns the number of options eliminated
+
+    // Only lines with between 2 and 'size' options for the value can form part of the fish
+    std::vector<int> baseLines;
+    for (int i = 0; i < GRIDSIZE; i++) {
+        int numPositions = linePositions[i].count();
+        if (numPositions >= 2 && numPositions <= size) baseLines.push_back(i);
+    }
+
+    int numBaseLines = baseLines.size();
+    if (numBaseLines < size) return 0;
+
+    // Iterate over every combination of 'size' base lines, stored as increasing indices into baseLines
+    std::vector<int> chosen(size);
+    for (int k = 0; k < size; k++) chosen[k] = k;
+
+    int numEliminated = 0;
+    while (true) {
+
+        std::bitset<GRIDSIZE> baseSet, coverSet;
+        for (const int &k : chosen) {
+            baseSet.set(baseLines[k]);
+            coverSet |= linePositions[baseLines[k]];
+        }
+
+        if ((int) coverSet.count() == size) {
+            for (int cover = 0; cover < GRIDSIZE; cover++) {
+                if (!coverSet[cover]) continue;
+                for (int other = 0; other < GRIDSIZE; other++) {
+                    if (baseSet[other]) continue;
+                    numEliminated += (baseIsRow ? this->eliminateOption(cover, other, val) : this->eliminateOption(other, cover, val));
+                }
+            }
+        }
+
+        // Advance to the next combination
+        int k = size - 1;
+        while (k >= 0 && chosen[k] == numBaseLines - size + k) k--;
+        if (k < 0) break;
+
+        chosen[k]++;
+        for (int m = k + 1; m < size; m++) chosen[m] = chosen[m - 1] + 1;
+    }
+
+    return numEliminated;
+}
+
+
 void Solver::saveState(std::pair<int, int> coord) {
 
     std::array<Cell, TOTALNUMCELLS> curState;
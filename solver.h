@@ -8,6 +8,7 @@
 #include <array>
 #include <vector>
 #include <utility>
+#include <chrono>
 
 #define GRIDSIZE 9
 #define BOXWIDTH 3
@@ -46,6 +47,16 @@ public:
 };
 
 
+// Propagation stages run when the solver would otherwise have to guess, in order of increasing cost
+enum Technique {
+    POINTING,
+    BOXLINE,
+    XWING,
+    SWORDFISH,
+    NUMTECHNIQUES
+};
+
+
 class Solver {
 public:
     Solver(std::string = "", std::string = "");
@@ -54,10 +65,28 @@ public:
     void printGridWithOptions();
     int solve(bool = false);
 
+    void setTechniqueEnabled(Technique, bool);
+    void printTechniqueStats();
+
 private:
+    struct TechniqueStats {
+        int numCalls = 0;
+        int numEliminations = 0;
+        std::chrono::steady_clock::duration timeTaken = std::chrono::steady_clock::duration::zero();
+    };
+
     Cell grid[GRIDSIZE][GRIDSIZE];
     std::stack<std::pair<std::array<Cell, TOTALNUMCELLS>, std::pair<int, int>>> state;
     int numCellsRemaining = GRIDSIZE * GRIDSIZE;
+
+    bool techniqueEnabled[NUMTECHNIQUES] = {true, true, true, true};
+    TechniqueStats techniqueStats[NUMTECHNIQUES];
+    int numGuesses = 0, numBacktracks = 0;
+    std::chrono::steady_clock::duration solveTime = std::chrono::steady_clock::duration::zero();
+
+    // rowPositions[val - 1][y] has bit x set if val is an option at (x, y), and colPositions[val - 1][x] likewise has bit y set
+    std::bitset<GRIDSIZE> rowPositions[GRIDSIZE][GRIDSIZE], colPositions[GRIDSIZE][GRIDSIZE];
+    std::vector<std::pair<int, int>> eliminatedCellCoords;
     
     void resetCells();
 
@@ -66,6 +95,15 @@ private:
 
     void reduceOptions(std::pair<int, int>, int val);
     void advancedReduceOptions(std::vector<std::pair<int, int>> &);
+    void advancedReduceUnits(const std::unordered_set<int> &, const std::unordered_set<int> &, const std::unordered_set<int> &);
+
+    bool applyTechniques();
+    void updateCandidatePositions();
+    int eliminateOption(int, int, int);
+    int pointingReduceOptions();
+    int boxLineReduceOptions();
+    int fishReduceOptions(int);
+    int fishReduceLines(int, int, std::bitset<GRIDSIZE> (&)[GRIDSIZE], bool);
 
     void saveState(std::pair<int, int> coord);
     bool revertState();